@@ -2,8 +2,10 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <time.h>
 
 #define MAX_NAME_LENGTH 50
+#define BENCH_RUNS 3
 
 /* --------------------
    Veri Yapilari
@@ -30,6 +32,26 @@ typedef struct RBTNode {
     struct RBTNode *left, *right, *parent;
 } RBTNode;
 
+/* --------------------
+   Yeniden Siralama Veri Yapilari
+   -------------------- */
+typedef enum { ORDER_LOAD, ORDER_DEGREE, ORDER_BFS } ReorderStrategy;
+typedef struct {
+    User* user;
+    int degree;
+    int index; // Orijinal liste sirasi (esit derecelerde kararli siralama icin)
+} UserOrder;
+typedef struct {
+    int seed;       // Bilesenin en yuksek dereceli kullanicisi (nodes indeksi)
+    int seedDegree;
+    int size;
+} ComponentOrder;
+typedef struct {
+    Friend* friend;
+    int rank;   // Arkadasin yeni liste sirasi
+    int index;  // Eski arkadas listesi sirasi (kararli siralama icin)
+} FriendRank;
+
 /* --------------------
    Fonksiyon Prototipleri
    -------------------- */
@@ -55,6 +77,19 @@ void detectCommunities(User* userList);
 int calcInfluenceArea(User* user, User* userList, bool* visited, int m);
 int influenceArea(User* user, User* userList);
 
+// Yeniden Siralama Fonksiyonlari
+int countFriends(Friend* friends);
+int compareDegreeDesc(const void* a, const void* b);
+int compareComponents(const void* a, const void* b);
+int compareFriendRank(const void* a, const void* b);
+void sortFriendsByRank(User* user, const int* rankOf, int m);
+const char* orderName(ReorderStrategy order);
+bool parseReorderStrategy(const char* arg, ReorderStrategy* strategy);
+bool readReorderStrategy(ReorderStrategy* strategy);
+void reorderUsers(User** userList, ReorderStrategy strategy);
+double timeInfluenceAreas(User* userList);
+void benchmarkReorder(User** userList, ReorderStrategy strategy, ReorderStrategy* listOrder);
+
 // Red-Black Tree Fonksiyonlari (Tek blok halinde)
 RBTNode* createRBTNode(int data);
 void leftRotate(RBTNode** root, RBTNode* x);
@@ -66,7 +101,7 @@ void inorderRBT(RBTNode* root);
 // Yardimci Fonksiyonlar
 void clearInputBuffer(void);
 void printMenu(void);
-void interactiveMode(User** userList, const char* filePath);
+void interactiveMode(User** userList, const char* filePath, ReorderStrategy listOrder);
 
 /* --------------------
    Fonksiyonlar: Kullanici ve Arkadas Islemleri
@@ -366,6 +401,279 @@ int influenceArea(User* user, User* userList) {
     return area;
 }
 
+/* --------------------
+   Fonksiyonlar: Yeniden Siralama
+   --------------------
+   Analiz fonksiyonlari her arkadas icin listeyi bastan tarar; bu nedenle
+   bir kullaniciya erisim maliyeti listedeki konumuyla orantilidir.
+   Yalnizca next isaretcileri yeniden baglanir, dugumler bellekte yer
+   degistirmez; kazanc sik aranan kullanicilarin basa alinmasiyla kisalan
+   liste taramalarindan gelir. Bu yapi icin derece siralamasi daha
+   uygundur. ID'ler degismez. */
+int countFriends(Friend* friends) {
+    int count = 0;
+    while (friends) {
+        count++;
+        friends = friends->next;
+    }
+    return count;
+}
+
+int compareDegreeDesc(const void* a, const void* b) {
+    const UserOrder* x = (const UserOrder*)a;
+    const UserOrder* y = (const UserOrder*)b;
+    if (x->degree != y->degree)
+        return y->degree - x->degree;
+    return x->index - y->index;
+}
+
+// Buyuk bilesenler once; esitlikte baslangic derecesi yuksek olan once.
+int compareComponents(const void* a, const void* b) {
+    const ComponentOrder* x = (const ComponentOrder*)a;
+    const ComponentOrder* y = (const ComponentOrder*)b;
+    if (x->size != y->size)
+        return y->size - x->size;
+    if (x->seedDegree != y->seedDegree)
+        return y->seedDegree - x->seedDegree;
+    return x->seed - y->seed;
+}
+
+int compareFriendRank(const void* a, const void* b) {
+    const FriendRank* x = (const FriendRank*)a;
+    const FriendRank* y = (const FriendRank*)b;
+    if (x->rank != y->rank)
+        return x->rank - y->rank;
+    return x->index - y->index;
+}
+
+// Arkadas listesini diziye alip qsort ile yeni siraya gore dizer ve yeniden baglar.
+void sortFriendsByRank(User* user, const int* rankOf, int m) {
+    int degree = countFriends(user->friends);
+    if (degree < 2)
+        return;
+    FriendRank* ranks = (FriendRank*)malloc(degree * sizeof(FriendRank));
+    Friend* fr = user->friends;
+    for (int i = 0; i < degree; i++) {
+        ranks[i].friend = fr;
+        ranks[i].rank = (fr->id >= 0 && fr->id < m) ? rankOf[fr->id] : m;
+        ranks[i].index = i;
+        fr = fr->next;
+    }
+    qsort(ranks, degree, sizeof(FriendRank), compareFriendRank);
+    for (int i = 0; i < degree; i++)
+        ranks[i].friend->next = (i + 1 < degree) ? ranks[i + 1].friend : NULL;
+    user->friends = ranks[0].friend;
+    free(ranks);
+}
+
+const char* orderName(ReorderStrategy order) {
+    switch (order) {
+        case ORDER_DEGREE:
+            return "derece";
+        case ORDER_BFS:
+            return "BFS (yuksek derece once)";
+        default:
+            return "yukleme/ekleme sirasi";
+    }
+}
+
+// Komut satiri degerini ("derece" veya "bfs") siralama yontemine cevirir.
+bool parseReorderStrategy(const char* arg, ReorderStrategy* strategy) {
+    if (strcmp(arg, "derece") == 0) {
+        *strategy = ORDER_DEGREE;
+        return true;
+    }
+    if (strcmp(arg, "bfs") == 0) {
+        *strategy = ORDER_BFS;
+        return true;
+    }
+    return false;
+}
+
+// Menuden siralama yontemini okur; 1 ve 2 disindaki girisleri reddeder.
+bool readReorderStrategy(ReorderStrategy* strategy) {
+    int choice;
+    printf("Siralama yontemi (1 - Derece, 2 - BFS (yuksek derece once)): ");
+    if (scanf("%d", &choice) != 1) {
+        clearInputBuffer();
+        printf("Gecersiz giris! Siralama yapilmadi.\n");
+        return false;
+    }
+    if (choice != 1 && choice != 2) {
+        printf("Gecersiz yontem! Siralama yapilmadi.\n");
+        return false;
+    }
+    *strategy = choice == 2 ? ORDER_BFS : ORDER_DEGREE;
+    return true;
+}
+
+/* ORDER_DEGREE: Dereceye gore azalan siralama; cok arkadasi olanlar basa
+   alinir, boylece en sik aranan kullanicilar listenin basinda bulunur.
+   ORDER_BFS: Yuksek derece oncelikli BFS; liste tarama maliyetine uygun
+   olarak bilesenler buyukten kucuge dizilir, her bilesen en yuksek dereceli
+   kullanicidan baslanarak gezilir ve komsular azalan derece ile kuyruga
+   eklenir. Arkadasi olmayan kullanicilar listenin sonunda kalir. */
+void reorderUsers(User** userList, ReorderStrategy strategy) {
+    int n = 0;
+    User* temp = *userList;
+    while (temp) {
+        n++;
+        temp = temp->next;
+    }
+    if (n < 2)
+        return;
+
+    int m = getMaxUserId(*userList) + 1;
+    UserOrder* nodes = (UserOrder*)malloc(n * sizeof(UserOrder));
+    int* indexOf = (int*)malloc(m * sizeof(int));
+    for (int i = 0; i < m; i++)
+        indexOf[i] = -1;
+    temp = *userList;
+    for (int i = 0; i < n; i++) {
+        nodes[i].user = temp;
+        nodes[i].degree = countFriends(temp->friends);
+        nodes[i].index = i;
+        if (temp->id >= 0)
+            indexOf[temp->id] = i;
+        temp = temp->next;
+    }
+
+    User** order = (User**)malloc(n * sizeof(User*));
+    if (strategy == ORDER_DEGREE) {
+        qsort(nodes, n, sizeof(UserOrder), compareDegreeDesc);
+        for (int i = 0; i < n; i++)
+            order[i] = nodes[i].user;
+    } else {
+        int* compOf = (int*)malloc(n * sizeof(int));
+        for (int i = 0; i < n; i++)
+            compOf[i] = -1;
+        ComponentOrder* comps = (ComponentOrder*)malloc(n * sizeof(ComponentOrder));
+        int* queue = (int*)malloc(n * sizeof(int));
+        UserOrder* neighbors = (UserOrder*)malloc(n * sizeof(UserOrder));
+
+        // 1. gecis: bilesenleri, boyutlarini ve baslangic kullanicilarini bul
+        int compCount = 0;
+        for (int s = 0; s < n; s++) {
+            if (compOf[s] >= 0)
+                continue;
+            ComponentOrder* c = &comps[compCount];
+            c->seed = s;
+            c->seedDegree = nodes[s].degree;
+            c->size = 0;
+            int head = 0, tail = 0;
+            compOf[s] = compCount;
+            queue[tail++] = s;
+            while (head < tail) {
+                int cur = queue[head++];
+                c->size++;
+                if (nodes[cur].degree > c->seedDegree) {
+                    c->seed = cur;
+                    c->seedDegree = nodes[cur].degree;
+                }
+                Friend* fr = nodes[cur].user->friends;
+                while (fr) {
+                    int idx = (fr->id >= 0 && fr->id < m) ? indexOf[fr->id] : -1;
+                    if (idx >= 0 && compOf[idx] < 0) {
+                        compOf[idx] = compCount;
+                        queue[tail++] = idx;
+                    }
+                    fr = fr->next;
+                }
+            }
+            compCount++;
+        }
+        qsort(comps, compCount, sizeof(ComponentOrder), compareComponents);
+
+        // 2. gecis: bilesenleri sirayla, baslangic kullanicisindan BFS ile diz
+        bool* queued = (bool*)calloc(n, sizeof(bool));
+        int head = 0, tail = 0;
+        for (int c = 0; c < compCount; c++) {
+            queued[comps[c].seed] = true;
+            queue[tail++] = comps[c].seed;
+            while (head < tail) {
+                int cur = queue[head++];
+                int count = 0;
+                Friend* fr = nodes[cur].user->friends;
+                while (fr) {
+                    int idx = (fr->id >= 0 && fr->id < m) ? indexOf[fr->id] : -1;
+                    if (idx >= 0 && !queued[idx]) {
+                        queued[idx] = true;
+                        neighbors[count++] = nodes[idx];
+                    }
+                    fr = fr->next;
+                }
+                qsort(neighbors, count, sizeof(UserOrder), compareDegreeDesc);
+                for (int i = 0; i < count; i++)
+                    queue[tail++] = neighbors[i].index;
+            }
+        }
+        for (int i = 0; i < n; i++)
+            order[i] = nodes[queue[i]].user;
+        free(queued);
+        free(neighbors);
+        free(queue);
+        free(comps);
+        free(compOf);
+    }
+
+    // Listeyi yeni siraya gore bagla ve arkadas listelerini de ayni siraya getir
+    int* rankOf = indexOf;
+    for (int i = 0; i < n; i++) {
+        if (order[i]->id >= 0)
+            rankOf[order[i]->id] = i;
+        order[i]->next = (i + 1 < n) ? order[i + 1] : NULL;
+    }
+    *userList = order[0];
+    for (int i = 0; i < n; i++)
+        sortFriendsByRank(order[i], rankOf, m);
+
+    free(order);
+    free(indexOf);
+    free(nodes);
+}
+
+/* Her kullanici icin etki alanini hesaplar. Olculmeyen bir isinma
+   turundan sonra BENCH_RUNS tur olculur ve en iyi sure (ms) dondurulur. */
+double timeInfluenceAreas(User* userList) {
+    long total = 0;
+    for (User* temp = userList; temp; temp = temp->next)
+        total += influenceArea(temp, userList);
+    double best = -1.0;
+    for (int run = 0; run < BENCH_RUNS; run++) {
+        clock_t start = clock();
+        for (User* temp = userList; temp; temp = temp->next)
+            influenceArea(temp, userList);
+        double elapsed = 1000.0 * (double)(clock() - start) / CLOCKS_PER_SEC;
+        if (best < 0.0 || elapsed < best)
+            best = elapsed;
+    }
+    printf("  (toplam etki alani: %ld)\n", total);
+    return best;
+}
+
+void benchmarkReorder(User** userList, ReorderStrategy strategy, ReorderStrategy* listOrder) {
+    if (!*userList) {
+        printf("Henuz kullanici yok.\n");
+        return;
+    }
+    ReorderStrategy previous = *listOrder;
+    printf("Yeniden siralama oncesi (mevcut sira: %s):\n", orderName(previous));
+    double before = timeInfluenceAreas(*userList);
+    printf("  En iyi sure (%d tur): %.2f ms\n", BENCH_RUNS, before);
+
+    clock_t start = clock();
+    reorderUsers(userList, strategy);
+    *listOrder = strategy;
+    double reorderTime = 1000.0 * (double)(clock() - start) / CLOCKS_PER_SEC;
+    printf("Yeniden siralama (%s): %.2f ms\n", orderName(strategy), reorderTime);
+
+    printf("Yeniden siralama sonrasi:\n");
+    double after = timeInfluenceAreas(*userList);
+    printf("  En iyi sure (%d tur): %.2f ms\n", BENCH_RUNS, after);
+    if (after > 0.0)
+        printf("Hizlanma (%s -> %s): %.2fx\n", orderName(previous), orderName(strategy), before / after);
+}
+
 /* --------------------
    Fonksiyonlar: Red-Black Tree Islemleri
    -------------------- */
@@ -497,15 +805,19 @@ void printMenu(void) {
     printf("7 - Etki Alanini Hesapla\n");
     printf("8 - Red-Black Tree Test\n");
     printf("9 - Dosyayi Duzenli Sekilde Yazdir\n");
-    printf("10 - Cikis\n");
+    printf("10 - Kullanicilari Yeniden Sirala\n");
+    printf("11 - Yeniden Siralama Benchmark\n");
+    printf("12 - Cikis\n");
     printf("Seciminiz: ");
 }
 
-void interactiveMode(User** userList, const char* filePath) {
+void interactiveMode(User** userList, const char* filePath, ReorderStrategy listOrder) {
     int choice, id1, id2, friendCount, i;
     char name[MAX_NAME_LENGTH];
     int treeCount, treeValue;
     RBTNode* rbRoot = NULL;
+    ReorderStrategy strategy;
+    User* oldHead;
 
     while (1) {
         printMenu();
@@ -520,7 +832,10 @@ void interactiveMode(User** userList, const char* filePath) {
                 scanf("%d", &id1);
                 printf("Kullanici ismini girin: ");
                 scanf("%s", name);
+                oldHead = *userList;
                 addUser(userList, id1, name);
+                if (*userList != oldHead)  // Yeni kullanici basa eklendi, siralama bozuldu
+                    listOrder = ORDER_LOAD;
                 printf("Kullanici basariyla eklendi!\n");
                 writeDataToFile(filePath, *userList);
                 break;
@@ -532,7 +847,10 @@ void interactiveMode(User** userList, const char* filePath) {
                 for (i = 0; i < friendCount; i++) {
                     printf("Arkadas ID girin: ");
                     scanf("%d", &id2);
+                    oldHead = *userList;
                     addFriend(userList, id1, id2);
+                    if (*userList != oldHead)
+                        listOrder = ORDER_LOAD;
                     printf("Arkadaslik eklendi!\n");
                 }
                 writeDataToFile(filePath, *userList);
@@ -601,6 +919,17 @@ void interactiveMode(User** userList, const char* filePath) {
                 printf("Veri dosyasi duzenli sekilde guncellendi.\n");
                 break;
             case 10:
+                if (readReorderStrategy(&strategy)) {
+                    reorderUsers(userList, strategy);
+                    listOrder = strategy;
+                    printf("Kullanicilar yeniden siralandi (%s).\n", orderName(strategy));
+                }
+                break;
+            case 11:
+                if (readReorderStrategy(&strategy))
+                    benchmarkReorder(userList, strategy, &listOrder);
+                break;
+            case 12:
                 printf("Cikis yapiliyor...\n");
                 return;
             default:
@@ -614,13 +943,25 @@ void interactiveMode(User** userList, const char* filePath) {
 /* --------------------
    Ana Fonksiyon
    -------------------- */
-int main() {
+int main(int argc, char* argv[]) {
     User* userList = NULL;
     const char* filePath = "C:/dosya_konumu/veriseti.txt";  // Kendi sistem konumunuza göre düzenleyin.
+    ReorderStrategy listOrder = ORDER_LOAD;
 
     // Dosyadaki veriyi okuyarak mevcut kullanicilari ve iliskileri yukluyoruz.
     readDataFromFile(filePath, &userList);
 
+    // Istege bagli: analizlerden once liste taramalarini kisaltmak icin yeniden siralama
+    // (ornek: ./sosyal_ag derece  veya  ./sosyal_ag bfs)
+    if (argc > 1) {
+        if (parseReorderStrategy(argv[1], &listOrder)) {
+            reorderUsers(&userList, listOrder);
+            printf("Kullanicilar yeniden siralandi (%s).\n", orderName(listOrder));
+        } else {
+            printf("Bilinmeyen siralama yontemi: %s (derece veya bfs)\n", argv[1]);
+        }
+    }
+
     // Ornek testler:
     if (userList) {
         printf("\n--- Iliski Agaci ---\n");
@@ -649,7 +990,7 @@ int main() {
     printf("\n");
 
     // Etkileşimli mod:
-    interactiveMode(&userList, filePath);
+    interactiveMode(&userList, filePath, listOrder);
 
     return 0;
 }
\ No newline at end of file